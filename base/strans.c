@@ -273,7 +273,16 @@ int find_identifier(struct environment *env, const char *lexem)
 	return 0;
 }
 
-void segment_compile_byte(struct environment *env, char byte)
+/* Address after the last byte in the segment buffer.  It is below the
+   pointer address while bytes skipped by ?skip are not followed by
+   other bytes. */
+unsigned long long segment_filled_address(struct environment *env)
+{
+	return get_segment(env)->base_address + get_segment(env)->size -
+		get_segment(env)->base_offset;
+}
+
+void segment_store_byte(struct environment *env, char byte)
 {
 	unsigned long long index = get_segment(env)->size;
 	if(index == get_segment(env)->real_size)
@@ -282,6 +291,13 @@ void segment_compile_byte(struct environment *env, char byte)
 			exit_error(ERROR_STATUS_SEG_BUFFER_OVERFLOW, NULL);
 	get_segment(env)->buffer[index] = byte;
 	get_segment(env)->size++;
+}
+
+void segment_compile_byte(struct environment *env, char byte)
+{
+	while(segment_filled_address(env) < get_segment(env)->pointer_address)
+		segment_store_byte(env, 0);
+	segment_store_byte(env, byte);
 	get_segment(env)->pointer_address++;
 }
 
@@ -297,11 +313,10 @@ void segment_compile(struct environment *env, unsigned long long value,
 unsigned long long convert_address(struct environment *env,
 	unsigned long long address, int size)
 {
-	unsigned long long pointer_address =
-		get_segment(env)->pointer_address;
+	unsigned long long filled_address = segment_filled_address(env);
 	unsigned long long base_address = get_segment(env)->base_address;
 	unsigned long long base_offset = get_segment(env)->base_offset;
-	if(address < base_address || address + size > pointer_address)
+	if(address < base_address || address + size > filled_address)
 		exit_error(ERROR_STATUS_SEG_ACCESS_INVALID, NULL);
 	return address - base_address + base_offset;
 }
@@ -439,6 +454,13 @@ void translator_reserve(struct environment *env)
 		segment_compile(env, 0, 1);
 }
 
+/* Reserves count bytes without writing them, they are zero when other
+   bytes follow them.  Trailing skipped bytes are not in the output. */
+void translator_skip(struct environment *env)
+{
+	get_segment(env)->pointer_address += pop_stack_elem(&env->stack);
+}
+
 void translator_read_one(struct environment *env)
 {
 	unsigned long long value = segment_read(env,
@@ -554,6 +576,127 @@ void translator_get_base(struct environment *env)
 	push_stack_elem(&env->stack, get_segment(env)->base_address);
 }
 
+void translator_get_filled(struct environment *env)
+{
+	push_stack_elem(&env->stack, segment_filled_address(env));
+}
+
+/* Identifiers starting with '_' are symbols.  They are listed from the
+   oldest, so string table offsets do not change when new identifiers
+   are defined between the symbol table and the string table. */
+int is_symbol(const struct identifier *id)
+{
+	return id->lexem[0] == '_' && id->lexem[1];
+}
+
+const struct identifier **list_symbols(struct environment *env,
+	unsigned long long *count)
+{
+	struct identifier *id_list;
+	const struct identifier **symbols;
+	unsigned long long index;
+
+	*count = 0;
+	for(id_list = env->id_list; id_list; id_list = id_list->next)
+		if(is_symbol(id_list))
+			(*count)++;
+	symbols = malloc((*count + 1) * sizeof(*symbols));
+	if(!symbols)
+		exit_error(ERROR_STATUS_ID_LIST_OVERFLOW, NULL);
+	index = *count;
+	for(id_list = env->id_list; id_list; id_list = id_list->next)
+		if(is_symbol(id_list))
+			symbols[--index] = id_list;
+	return symbols;
+}
+
+unsigned long long lexem_length(const char *lexem)
+{
+	unsigned long long length = 0;
+	for(; *lexem; lexem++)
+		length++;
+	return length;
+}
+
+int compare_values(const void *one, const void *two)
+{
+	unsigned long long value_one = *(const unsigned long long *)one;
+	unsigned long long value_two = *(const unsigned long long *)two;
+	return (value_one > value_two) - (value_one < value_two);
+}
+
+/* The smallest of sorted values above the value, or the limit */
+unsigned long long next_value(const unsigned long long *values,
+	unsigned long long count, unsigned long long value,
+	unsigned long long limit)
+{
+	unsigned long long low = 0, high = count;
+	while(low < high)
+	{
+		unsigned long long middle = low + (high - low) / 2;
+		if(values[middle] > value)
+			high = middle;
+		else
+			low = middle + 1;
+	}
+	return low < count ? values[low] : limit;
+}
+
+/* Names of all symbols, each ends with 0, after a leading 0 */
+void translator_string_table(struct environment *env)
+{
+	unsigned long long count, index;
+	const struct identifier **symbols = list_symbols(env, &count);
+	const char *symb;
+
+	segment_compile_byte(env, 0);
+	for(index = 0; index < count; index++)
+	{
+		for(symb = symbols[index]->lexem; *symb; symb++)
+			segment_compile_byte(env, *symb);
+		segment_compile_byte(env, 0);
+	}
+	free(symbols);
+}
+
+/* ELF32 symbols with values from low to high: name offset in the string
+   table, value, size up to the next symbol, info, other and section. */
+void translator_symbol_table(struct environment *env)
+{
+	unsigned long long info = pop_stack_elem(&env->stack);
+	unsigned long long section = pop_stack_elem(&env->stack);
+	unsigned long long high = pop_stack_elem(&env->stack);
+	unsigned long long low = pop_stack_elem(&env->stack);
+	unsigned long long count, index, in_range = 0, name = 1;
+	const struct identifier **symbols = list_symbols(env, &count);
+	unsigned long long *values = malloc((count + 1) * sizeof(*values));
+
+	if(!values)
+		exit_error(ERROR_STATUS_ID_LIST_OVERFLOW, NULL);
+	for(index = 0; index < count; index++)
+		if(symbols[index]->value >= low && symbols[index]->value < high)
+			values[in_range++] = symbols[index]->value;
+	qsort(values, in_range, sizeof(*values), &compare_values);
+
+	for(index = 0; index < count; index++)
+	{
+		unsigned long long value = symbols[index]->value;
+		if(value >= low && value < high)
+		{
+			segment_compile(env, name, 4);
+			segment_compile(env, value, 4);
+			segment_compile(env,
+				next_value(values, in_range, value, high) - value, 4);
+			segment_compile(env, info, 1);
+			segment_compile(env, 0, 1);
+			segment_compile(env, section, 2);
+		}
+		name += lexem_length(symbols[index]->lexem) + 1;
+	}
+	free(values);
+	free(symbols);
+}
+
 void translator_print(struct environment *env)
 {
 	unsigned long long value = pop_stack_elem(&env->stack);
@@ -579,6 +722,7 @@ const struct operator translator_operators[] =
 	{ &translator_compile_eight, "?8." },
 	{ &translator_compile, "?." },
 	{ &translator_reserve, "?res" },
+	{ &translator_skip, "?skip" },
 	{ &translator_read_one, "?1@" },
 	{ &translator_read_two, "?2@" },
 	{ &translator_read_four, "?4@" },
@@ -596,6 +740,9 @@ const struct operator translator_operators[] =
 	{ &translator_set_data_endianness, "?endianness" },
 	{ &translator_get_offset, "?$" },
 	{ &translator_get_base, "?$$" },
+	{ &translator_get_filled, "?filled" },
+	{ &translator_string_table, "?strtab" },
+	{ &translator_symbol_table, "?symtab" },
 	{ &translator_print, "?print" },
 };
 
@@ -0,0 +1,85 @@
+#!/bin/sh
+# End-to-end cryptrobber benchmark.
+#
+# Every sample is encrypted with every key, then cryptrobber is run on the
+# ciphertext.  One line per run is written to the results file:
+#
+#   sample   - sample file name
+#   bytes    - sample size
+#   key      - key used for encryption (hex, as cryptrobber prints it)
+#   status   - ok, wrong (other key or language), error, timeout
+#   wall_s   - wall time in seconds
+#   keys     - number of keys tried
+#   keys/s   - keys tried per second
+#   bytes/s  - bytes deciphered and scored per second (keys * bytes / wall)
+#   rss_kb   - peak resident set size
+#   lang     - recovered language
+#   found    - recovered key
+#
+# Environment:
+#   BENCH_SAMPLES  sample names to run (default: all six)
+#   BENCH_KEYS     comma separated keys (default: see below)
+#   BENCH_TIMEOUT  seconds before a run is killed (default: 300)
+#   BENCH_RESULTS  results file (default: bench/results.txt)
+#   BENCH_FLAGS    cryptrobber options, like -l
+
+set -e
+
+cd "$(dirname "$0")/.."
+
+samples=${BENCH_SAMPLES:-"orwell quixote kernel-options man spinlocks speculation"}
+keys=${BENCH_KEYS:-"2a,e7,01 20,31 32,6b 4f 21"}
+limit=${BENCH_TIMEOUT:-300}
+results=${BENCH_RESULTS:-bench/results.txt}
+flags=${BENCH_FLAGS:-}
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+{
+	echo "# cryptrobber benchmark $(date -u '+%Y-%m-%d %H:%M:%S') UTC"
+	echo "# $(uname -srm), timeout ${limit}s, options: ${flags:-none}"
+	printf '%-16s %7s %-9s %-7s %9s %9s %9s %11s %7s %-8s %s\n' \
+		sample bytes key status wall_s keys keys/s bytes/s rss_kb \
+		lang found
+} > "$results"
+
+echo "$keys" | tr ',' '\n' | while read -r key
+do
+	for sample in $samples
+	do
+		file=samples/$sample.txt
+		./encrypt "$(echo "$key" | tr -d ' ')" < "$file" > "$work/cipher"
+		bench/runstat -t "$limit" "$work/stat" \
+			./cryptrobber $flags < "$work/cipher" \
+			> "$work/plain" 2> "$work/err" || true
+		awk -v sample="$sample" -v key="$key" \
+			-v bytes="$(wc -c < "$file")" \
+			-v same="$(cmp -s "$file" "$work/plain" && echo 1)" \
+			-v stat="$(cat "$work/stat")" '
+			/^keys / { keys = $2 + 0; next }
+			++n == 1 { lang = $0 }
+			n == 2 { found = $0 }
+			END {
+				split(stat, s, " ")
+				wall = s[1] / 1000
+				if(s[3] == "timeout")
+					status = "timeout"
+				else if(lang != "english" && lang != "spanish")
+					status = "error"
+				else if(found != key || !same)
+					status = "wrong"
+				else
+					status = "ok"
+				if(lang == "")
+					lang = "-"
+				if(found == "")
+					found = "-"
+				rate = wall > 0 ? keys / wall : 0
+				printf "%-16s %7d %-9s %-7s %9.3f %9d %9.0f %11.0f %7d %-8s %s\n",
+					sample, bytes, key, status, wall, keys,
+					rate, rate * bytes, s[2], lang, found
+			}' "$work/err" >> "$results"
+		tail -n 1 "$results"
+	done
+done
@@ -0,0 +1,55 @@
+#!/bin/sh
+# Regression runs: texts are encrypted with known keys and cryptrobber
+# has to give the language, the key and the text back.  One line per run
+# is written, and the status is not 0 if any run failed.
+
+cd "$(dirname "$0")/.."
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+failed=0
+
+# Runs cryptrobber with options on text encrypted with key, the key is
+# expected in its error stream as "6b 4f 21" for 6b4f21
+check()
+{
+	name=$1 text=$2 key=$3
+	shift 3
+	./encrypt "$key" < "$text" > "$work/cipher"
+	./cryptrobber -q "$@" < "$work/cipher" > "$work/plain" 2> "$work/err"
+	expected=$(echo "$key" | sed 's/../& /g; s/ $//')
+	if cmp -s "$text" "$work/plain" &&
+		[ "$(tail -n 1 "$work/err")" = "$expected" ]
+	then
+		echo "ok     $name"
+	else
+		echo "FAILED $name"
+		failed=1
+	fi
+}
+
+# Text over 64 KB: larger than the input buffer of '-w' streaming
+: > "$work/long"
+while [ "$(wc -c < "$work/long")" -lt 120000 ]
+do
+	cat README doc/sml_language.txt >> "$work/long"
+done
+
+check "readme" README 3132
+check "long text, 2 byte key" "$work/long" 3132
+check "streamed, 2 byte key" "$work/long" 3132 -w 4000
+check "streamed, 3 byte key" "$work/long" 6b4f21 -w 4000 -l
+check "streamed, 3 byte key, crib" "$work/long" 6b4f21 -w 4000 \
+	-c cryptrobber
+# 4 bytes of the key repeat with period 8, so length 4 passes first
+check "8 byte key, length 4 passes" samples/orwell.txt 0123456789abcdef -l
+
+# Heap and arena words, bench/arena writes its own lines
+./bench/arena > "$work/arena"
+cat "$work/arena"
+if grep -qv '^ok ' "$work/arena" || [ ! -s "$work/arena" ]
+then
+	failed=1
+fi
+
+exit $failed
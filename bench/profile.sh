@@ -0,0 +1,73 @@
+#!/bin/sh
+# Per word profile from a histogram of cryptrobber -p:
+#
+#   ./cryptrobber -p histogram < path_to_encrypted_data > /dev/null
+#   sh bench/profile.sh ./cryptrobber histogram
+#
+# Histogram lines are "count eip esi caller caller2" in hex.  Every
+# address is given the symbol nearest below it: eip is in the native word
+# which ran, esi in the SML word which called it and caller in the SML
+# word which called that one.  esi is 0 when a native word used it for its
+# own values, such samples are "(native)".  Two tables are written, samples
+# by native word and by SML word with its caller, most samples first.
+
+set -e
+
+if [ $# -ne 2 ]
+then
+	echo "usage: $0 program histogram" >&2
+	exit 1
+fi
+
+nm -n "$1" | awk -v histogram="$2" '
+	function hex(s,   i, n)
+	{
+		n = 0
+		for(i = 1; i <= length(s); i++)
+			n = n * 16 + index("0123456789abcdef", substr(s, i, 1)) - 1
+		return n
+	}
+
+	function word(address,   low, high, middle)
+	{
+		if(address < addresses[1])
+			return "-"
+		low = 1
+		high = count
+		while(low < high) {
+			middle = int((low + high + 1) / 2)
+			if(addresses[middle] <= address)
+				low = middle
+			else
+				high = middle - 1
+		}
+		return names[low]
+	}
+
+	{
+		addresses[++count] = hex($1)
+		names[count] = $3
+	}
+
+	END {
+		while((getline line < histogram) > 0) {
+			split(line, field, " ")
+			n = hex(field[1])
+			total += n
+			native[word(hex(field[2]))] += n
+			sml = hex(field[3]) ? word(hex(field[3])) : "(native)"
+			caller[sml " < " word(hex(field[4]))] += n
+		}
+		if(total == 0)
+			exit
+		print "# samples by native word"
+		for(w in native)
+			printf "%8d %5.1f%% %s\n", native[w],
+				100 * native[w] / total, w | "sort -rn"
+		close("sort -rn")
+		print "# samples by SML word < caller"
+		for(w in caller)
+			printf "%8d %5.1f%% %s\n", caller[w],
+				100 * caller[w] / total, w | "sort -rn"
+		close("sort -rn")
+	}'
@@ -0,0 +1,105 @@
+/*
+	Run Statistics Collector
+	runs a command and reports its wall time, peak RSS and exit status
+*/
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#define ERROR_STATUS_ARG 1
+#define ERROR_STATUS_OPEN 2
+#define ERROR_STATUS_FORK 3
+#define ERROR_STATUS_WAIT 4
+
+const char *error_msgs[] =
+{
+	"Usage: runstat [-t seconds] stat_file command [argument...]",
+	"Unable to open file: ",
+	"Unable to start command",
+	"Unable to wait for command"
+};
+
+void exit_error(int status, const char *msg)
+{
+	if(msg)
+		fprintf(stderr, "Error: %s%s\n", error_msgs[status - 1], msg);
+	else
+		fprintf(stderr, "Error: %s\n", error_msgs[status - 1]);
+	exit(status);
+}
+
+pid_t child;
+
+void kill_child(int signum)
+{
+	(void)signum;
+	kill(child, SIGKILL);
+}
+
+unsigned long long time_ms()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000ULL + now.tv_nsec / 1000000;
+}
+
+/* Output line is "wall_ms max_rss_kb status", where status is the exit code
+   of the command, or "timeout" if it was killed after the time limit. */
+int main(int argc, char **argv)
+{
+	unsigned int limit = 0;
+	unsigned long long start;
+	struct rusage usage;
+	int status;
+	FILE *stat_file;
+
+	if(argc > 2 && !strcmp(argv[1], "-t"))
+	{
+		limit = atoi(argv[2]);
+		argc -= 2;
+		argv += 2;
+	}
+	if(argc < 3)
+		exit_error(ERROR_STATUS_ARG, NULL);
+	stat_file = fopen(argv[1], "w");
+	if(!stat_file)
+		exit_error(ERROR_STATUS_OPEN, argv[1]);
+
+	start = time_ms();
+	child = fork();
+	if(child == -1)
+		exit_error(ERROR_STATUS_FORK, NULL);
+	if(!child)
+	{
+		execvp(argv[2], argv + 2);
+		_exit(127);
+	}
+	if(limit)
+	{
+		signal(SIGALRM, &kill_child);
+		alarm(limit);
+	}
+	while(wait4(child, &status, 0, &usage) == -1)
+		if(errno != EINTR)
+			exit_error(ERROR_STATUS_WAIT, NULL);
+	alarm(0);
+
+	fprintf(stat_file, "%llu %ld ", time_ms() - start, usage.ru_maxrss);
+	if(WIFSIGNALED(status) && WTERMSIG(status) == SIGKILL && limit)
+		fprintf(stat_file, "timeout\n");
+	else if(WIFSIGNALED(status))
+		fprintf(stat_file, "signal%d\n", WTERMSIG(status));
+	else
+		fprintf(stat_file, "%d\n", WEXITSTATUS(status));
+	fclose(stat_file);
+	return 0;
+}
@@ -0,0 +1,118 @@
+#!/bin/sh
+# Toolchain benchmark.
+#
+# Synthetic .sts programs of growing size are generated for every case,
+# then base/smack and base/strans are timed on them.  One line per stage
+# is written to the results file:
+#
+#   case     - what the program is made of (see generate below)
+#   n        - size parameter of the case
+#   stage    - smack or strans
+#   tokens   - lexems of stage input
+#   bytes    - bytes of stage output
+#   wall_s   - wall time in seconds
+#   tokens/s - input lexems per second
+#   bytes/s  - output bytes per second
+#   rss_kb   - peak resident set size
+#
+# Rates should not fall when n grows; if they do, the stage is
+# superlinear in what the case has many of.
+#
+# Environment:
+#   TOOLCHAIN_CASES    cases to run (default: all)
+#   TOOLCHAIN_SIZES    values of n (default: 1000 2000 4000 8000)
+#   TOOLCHAIN_RESULTS  results file (default: bench/toolchain.txt)
+
+set -e
+
+cd "$(dirname "$0")/.."
+
+cases=${TOOLCHAIN_CASES:-"macros nesting identifiers reserve table segments"}
+sizes=${TOOLCHAIN_SIZES:-"1000 2000 4000 8000"}
+results=${TOOLCHAIN_RESULTS:-bench/toolchain.txt}
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+# Program of the case with size n on output.  Programs do not define
+# 'literal', so numbers go to strans as they are.
+generate()
+{
+	awk -v kind="$1" -v n="$2" 'BEGIN {
+		print "?create ?? _segment _segment ?choose"
+		if(kind == "macros") {
+			# n macros, each called once: find_macro
+			for(i = 0; i < n; i++)
+				printf "[ m%d 1 %%1%% ?\047 ]\n", i
+			for(i = 0; i < n; i++)
+				printf "m%d %x\n", i, i % 256
+		} else if(kind == "nesting") {
+			# macros calling each other n / 10 deep
+			depth = int(n / 10)
+			print "[ m0 1 %1% ?\047 ]"
+			for(i = 1; i <= depth; i++)
+				printf "[ m%d 1 m%d %%1%% ]\n", i, i - 1
+			for(i = 0; i < 10; i++)
+				printf "m%d %x\n", depth, i
+		} else if(kind == "identifiers") {
+			# n labels, each used once: find_identifier
+			for(i = 0; i < n; i++)
+				printf "?$ ?? _label%d 0 ?\047\n", i
+			for(i = 0; i < n; i++)
+				printf "_label%d ?drop\n", i
+		} else if(kind == "reserve") {
+			# n / 10 blocks of 1000h zero bytes
+			for(i = 0; i < n / 10; i++)
+				print "1000 ?res"
+		} else if(kind == "table") {
+			# n rows of 4 words
+			print "4 ?size"
+			for(i = 0; i < n; i++)
+				printf "%x ?. %x ?. %x ?. %x ?.\n", i, i * 3, i * 7, i * 11
+		} else if(kind == "segments") {
+			# n / 10 segments, bytes go to the last one: get_segment
+			for(i = 0; i < n / 10; i++)
+				print "?create ?drop"
+			printf "%x ?choose\n", int(n / 10)
+			for(i = 0; i < n; i++)
+				printf "%x ?\047\n", i % 256
+		}
+	}'
+}
+
+# Runs stage on input, appends its line to results
+measure()
+{
+	bench/runstat "$work/stat" sh -c "$3" < "$4" > "$5"
+	awk -v kind="$1" -v n="$2" -v stage="$6" \
+		-v tokens="$(wc -w < "$7")" -v bytes="$(wc -c < "$5")" '
+		{
+			wall = $1 / 1000
+			if($3 != "0")
+				status = "failed"
+			rate = wall > 0 ? 1 / wall : 0
+			printf "%-12s %6d %-7s %9d %9d %8.3f %11.0f %11.0f %7d%s\n",
+				kind, n, stage, tokens, bytes, wall, tokens * rate,
+				bytes * rate, $2, status ? " " status : ""
+		}' "$work/stat" >> "$results"
+	tail -n 1 "$results"
+}
+
+{
+	echo "# toolchain benchmark $(date -u '+%Y-%m-%d %H:%M:%S') UTC"
+	echo "# $(uname -srm)"
+	printf '%-12s %6s %-7s %9s %9s %8s %11s %11s %7s\n' \
+		case n stage tokens bytes wall_s tokens/s bytes/s rss_kb
+} > "$results"
+
+for kind in $cases
+do
+	for n in $sizes
+	do
+		generate "$kind" "$n" > "$work/program.sts"
+		measure "$kind" "$n" "base/smack $work/program.sts" /dev/null \
+			"$work/program.sml" smack "$work/program.sts"
+		measure "$kind" "$n" base/strans "$work/program.sml" \
+			"$work/program.bin" strans "$work/program.sml"
+	done
+done